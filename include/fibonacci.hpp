@@ -1,14 +1,18 @@
 /**
  * @file fibonacci.hpp
  * 
- * @brief Include file for the fibonacci and fibonacciRacer free functions.
+ * @brief Include file for the fibonacci and fibonacciRacer free functions, and
+ *        the lazy FibonacciSequence view.
  */
 
 #ifndef FIBONACCI_HPP
 #define FIBONACCI_HPP
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <ranges>
 #include "uint256_t.hpp"
 
 namespace fibonacci {
@@ -47,6 +51,86 @@ void fibonacciRacer(std::array<uint256_t, MAX_256_BIT_FIBONACCI_INDEX + 1>& resu
  */
 uint256_t fibonacci(int n);
 
+/**
+ * @brief A lazy view over the Fibonacci numbers in an index range.
+ * 
+ * @details Only two `uint256_t` values are held as state: the current Fibonacci
+ *          number and the one after it. Each increment of the iterator costs a
+ *          single addition, so the view can be consumed incrementally with
+ *          `std::views::take`, `std::views::filter` and other range adaptors
+ *          without computing or storing the rest of the range.
+ */
+class FibonacciSequence : public std::ranges::view_interface<FibonacciSequence> {
+public:
+    class iterator {
+    public:
+        using value_type = uint256_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        iterator() = default;
+        iterator(int index, const uint256_t& current, const uint256_t& next)
+            : index(index), current(current), next(next) {}
+
+        uint256_t operator*() const { return current; }
+        int position() const { return index; }
+
+        iterator& operator++() {
+            uint256_t sum = current + next;
+            current = next;
+            next = sum;
+            ++index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs) {
+            return lhs.index == rhs.index;
+        }
+
+    private:
+        int index = 0;
+        uint256_t current;
+        uint256_t next;
+    };
+
+    FibonacciSequence() = default;
+    FibonacciSequence(int start, int end, const uint256_t& first, const uint256_t& second)
+        : start(start), end_(end), first(first), second(second) {}
+
+    iterator begin() const { return iterator(start, first, second); }
+    iterator end() const { return iterator(end_ + 1, uint256_t(0), uint256_t(0)); }
+    std::size_t size() const { return static_cast<std::size_t>(end_ + 1 - start); }
+
+private:
+    int start = 0;
+    int end_ = -1;
+    uint256_t first;
+    uint256_t second;
+};
+
+/**
+ * @brief Creates a lazy view over the Fibonacci numbers from index `start` to `end`.
+ * 
+ * @param[in] start The starting index (inclusive) of the range to view.
+ * @param[in] end The ending index (inclusive) of the range to view.
+ * 
+ * @pre `0 <= start <= end + 1` and `end <= MAX_256_BIT_FIBONACCI_INDEX`
+ * @post The returned view yields F(start), F(start + 1), ..., F(end).
+ * 
+ * @note Seeding F(start) and F(start + 1) uses a single matrix exponentiation,
+ *       so no elements before `start` are ever computed.
+ */
+FibonacciSequence sequence(int start, int end);
+
 } // namespace fibonacci
 
+// The view's iterators do not refer back to the view, so they may outlive it
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<fibonacci::FibonacciSequence> = true;
+
 #endif // FIBONACCI_HPP
\ No newline at end of file
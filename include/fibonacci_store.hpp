@@ -0,0 +1,86 @@
+/**
+ * @file fibonacci_store.hpp
+ * 
+ * @brief Include file for the FibonacciCheckpointStore class.
+ */
+
+#ifndef FIBONACCI_STORE_HPP
+#define FIBONACCI_STORE_HPP
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "fibonacci.hpp"
+#include "uint256_t.hpp"
+
+namespace fibonacci {
+
+/**
+ * @brief A sparse store of Fibonacci numbers that keeps only a checkpoint every
+ *        `interval` indices and rebuilds the values in between on demand.
+ * 
+ * @details Each checkpoint is the consecutive pair (F(k), F(k + 1)) for k a
+ *          multiple of `interval`. Any index is rebuilt from the checkpoint at
+ *          or below it with fewer than `interval` additions, so `interval`
+ *          trades memory for lookup cost. Use `memoryBytes` and
+ *          `maxLookupAdditions` to tune it.
+ */
+class FibonacciCheckpointStore {
+public:
+    /**
+     * @brief Builds the checkpoints covering indices 0 to `lastIndex`.
+     * 
+     * @param[in] lastIndex The highest index (inclusive) the store can rebuild.
+     * @param[in] interval The distance between consecutive checkpoints.
+     * 
+     * @pre `0 <= lastIndex <= MAX_256_BIT_FIBONACCI_INDEX` and `interval >= 1`
+     */
+    FibonacciCheckpointStore(int lastIndex, int interval);
+
+    /**
+     * @brief Rebuilds the n-th Fibonacci number from the nearest checkpoint.
+     * 
+     * @pre `0 <= n <= lastIndex()`
+     * 
+     * @return The n-th Fibonacci number.
+     */
+    uint256_t at(int n) const;
+
+    /**
+     * @brief Creates a lazy view over the Fibonacci numbers from index `start` to `end`,
+     *        seeded from the nearest checkpoint at or below `start`.
+     * 
+     * @pre `0 <= start <= end + 1` and `end <= lastIndex()`
+     */
+    FibonacciSequence range(int start, int end) const;
+
+    int lastIndex() const { return last; }
+    int interval() const { return step; }
+    std::size_t checkpointCount() const { return checkpoints.size(); }
+
+    /**
+     * @brief Returns the number of additions `at(n)` performs to rebuild index `n`.
+     */
+    int lookupAdditions(int n) const { return n % step; }
+
+    /**
+     * @brief Returns the worst-case number of additions for a single lookup.
+     */
+    int maxLookupAdditions() const;
+
+    /**
+     * @brief Returns the bytes held by the store, including its checkpoint buffer.
+     */
+    std::size_t memoryBytes() const;
+
+private:
+    typedef std::array<uint256_t, 2> Checkpoint; // { F(k), F(k + 1) }
+
+    int last;
+    int step;
+    std::vector<Checkpoint> checkpoints;
+};
+
+} // namespace fibonacci
+
+#endif // FIBONACCI_STORE_HPP
@@ -1,7 +1,7 @@
 /**
  * @file fibonacci.cpp
  * 
- * @brief Implementation file for the fibonacci and fibonacciRacer
+ * @brief Implementation file for the fibonacci, fibonacciRacer and sequence
  *        free functions declared in include/fibonacci.hpp.
  */
 
@@ -84,4 +84,12 @@ uint256_t fibonacci(int n) {
 
 }
 
+FibonacciSequence sequence(int start, int end) {
+    // M^start = [[F(start + 1), F(start)], [F(start), F(start - 1)]]
+    if (start == 0) return FibonacciSequence(start, end, uint256_t(0), uint256_t(1));
+    auto fibMatrix = makeFibMatrix();
+    fibPower(fibMatrix, start);
+    return FibonacciSequence(start, end, fibMatrix[0][1], fibMatrix[0][0]);
+}
+
 } // namespace fibonacci
@@ -0,0 +1,66 @@
+/**
+ * @file fibonacci_store.cpp
+ * 
+ * @brief Implementation file for the FibonacciCheckpointStore class declared
+ *        in include/fibonacci_store.hpp.
+ */
+
+#include "fibonacci_store.hpp"
+#include "fibonacci.hpp"
+#include "uint256_t.hpp"
+
+namespace fibonacci {
+
+FibonacciCheckpointStore::FibonacciCheckpointStore(int lastIndex, int interval)
+    : last(lastIndex), step(interval) {
+    checkpoints.reserve(static_cast<std::size_t>(lastIndex / interval + 1));
+
+    // Walk the sequence once, keeping the pair at every multiple of the interval
+    uint256_t current(0);
+    uint256_t next(1);
+    for (int i = 0; i <= lastIndex; ++i) {
+        if (i % interval == 0) {
+            checkpoints.push_back({ current, next });
+        }
+        uint256_t sum = current + next;
+        current = next;
+        next = sum;
+    }
+}
+
+uint256_t FibonacciCheckpointStore::at(int n) const {
+    const Checkpoint& checkpoint = checkpoints[static_cast<std::size_t>(n / step)];
+    uint256_t current = checkpoint[0];
+    uint256_t next = checkpoint[1];
+    for (int i = n % step; i > 0; --i) {
+        uint256_t sum = current + next;
+        current = next;
+        next = sum;
+    }
+    return current;
+}
+
+FibonacciSequence FibonacciCheckpointStore::range(int start, int end) const {
+    if (start > end) return FibonacciSequence(start, end, uint256_t(0), uint256_t(0));
+
+    // Seed the view from the checkpoint, then advance it to start
+    const int base = start - start % step;
+    const Checkpoint& checkpoint = checkpoints[static_cast<std::size_t>(base / step)];
+    auto it = FibonacciSequence::iterator(base, checkpoint[0], checkpoint[1]);
+    for (int i = base; i < start; ++i) {
+        ++it;
+    }
+    const uint256_t first = *it;
+    ++it;
+    return FibonacciSequence(start, end, first, *it);
+}
+
+int FibonacciCheckpointStore::maxLookupAdditions() const {
+    return last < step ? last : step - 1;
+}
+
+std::size_t FibonacciCheckpointStore::memoryBytes() const {
+    return sizeof(*this) + checkpoints.capacity() * sizeof(Checkpoint);
+}
+
+} // namespace fibonacci
@@ -1,7 +1,8 @@
 /**
  * @file test.cpp
  * 
- * @brief Test driver for the fibonacci and fibonacciRacer functions.
+ * @brief Test driver for the fibonacci, fibonacciRacer and sequence functions,
+ *        and the FibonacciCheckpointStore class.
  * 
  * @details The test driver runs and times the fibonacci and fibonacciRacer
  *          functions for various inputs, and verifies the correctness of their
@@ -12,11 +13,13 @@
 #include <chrono>
 #include <cstdint>
 #include <iostream>
+#include <ranges>
 #include <string>
 #include <sstream>
 
 #include "choose_timer_unit.hpp"
 #include "fibonacci.hpp"
+#include "fibonacci_store.hpp"
 #include "uint256_t.hpp"
 // Check if the user cheated by using the precomputed solutions
 #ifdef PRECOMPUTE_FIBONACCI_HPP
@@ -44,6 +47,92 @@ void fibonacciVerifier(std::array<uint256_t, fibonacci::MAX_256_BIT_FIBONACCI_IN
 
 }
 
+static_assert(std::ranges::view<fibonacci::FibonacciSequence>);
+static_assert(std::ranges::forward_range<fibonacci::FibonacciSequence>);
+static_assert(std::ranges::borrowed_range<fibonacci::FibonacciSequence>);
+
+void sequenceVerifier() {
+    bool allGood = true;
+    for (int start : {0, 1, 2, 93, 200, fibonacci::MAX_256_BIT_FIBONACCI_INDEX}) {
+        int i = start;
+        for (const uint256_t& value : fibonacci::sequence(start, fibonacci::MAX_256_BIT_FIBONACCI_INDEX)) {
+            if (value != FIBONACCI_SOLUTIONS[i]) {
+                std::cout << "Sequence mismatch at index " << i << " (start " << start << "): expected "
+                          << FIBONACCI_SOLUTIONS[i] << ", got " << value << std::endl;
+                allGood = false;
+            }
+            ++i;
+        }
+        if (i != fibonacci::MAX_256_BIT_FIBONACCI_INDEX + 1) {
+            std::cout << "Sequence from " << start << " stopped early at index " << i << std::endl;
+            allGood = false;
+        }
+    }
+
+    // Adaptors must compose with the lazy view
+    auto isEven = [](const uint256_t& value) { return (value & uint256_t(1)) == uint256_t(0); };
+    auto evens = fibonacci::sequence(10, fibonacci::MAX_256_BIT_FIBONACCI_INDEX)
+               | std::views::filter(isEven)
+               | std::views::take(5);
+    int expectedIndex = 12; // Every third Fibonacci number is even
+    for (const uint256_t& value : evens) {
+        if (value != FIBONACCI_SOLUTIONS[expectedIndex]) {
+            std::cout << "Filtered sequence mismatch at index " << expectedIndex << ": expected "
+                      << FIBONACCI_SOLUTIONS[expectedIndex] << ", got " << value << std::endl;
+            allGood = false;
+        }
+        expectedIndex += 3;
+    }
+    if (std::ranges::distance(fibonacci::sequence(5, 4)) != 0) {
+        std::cout << "Empty sequence yielded values" << std::endl;
+        allGood = false;
+    }
+
+    if (!allGood) {
+        throw 1;
+    }
+    std::cout << "All sequence values match!" << std::endl;
+}
+
+void storeVerifier() {
+    bool allGood = true;
+    for (int interval : {1, 7, 32, fibonacci::MAX_256_BIT_FIBONACCI_INDEX + 1}) {
+        const fibonacci::FibonacciCheckpointStore store(fibonacci::MAX_256_BIT_FIBONACCI_INDEX, interval);
+        for (int i = 0; i <= fibonacci::MAX_256_BIT_FIBONACCI_INDEX; ++i) {
+            if (store.at(i) != FIBONACCI_SOLUTIONS[i]) {
+                std::cout << "Store mismatch at index " << i << " (interval " << interval << "): expected "
+                          << FIBONACCI_SOLUTIONS[i] << ", got " << store.at(i) << std::endl;
+                allGood = false;
+            }
+            if (store.lookupAdditions(i) > store.maxLookupAdditions()) {
+                std::cout << "Store lookup cost at index " << i << " exceeds reported maximum" << std::endl;
+                allGood = false;
+            }
+        }
+        int i = 45;
+        for (const uint256_t& value : store.range(45, 300)) {
+            if (value != FIBONACCI_SOLUTIONS[i]) {
+                std::cout << "Store range mismatch at index " << i << " (interval " << interval << "): expected "
+                          << FIBONACCI_SOLUTIONS[i] << ", got " << value << std::endl;
+                allGood = false;
+            }
+            ++i;
+        }
+        if (i != 301) {
+            std::cout << "Store range stopped early at index " << i << std::endl;
+            allGood = false;
+        }
+        std::cout << "Checkpoint interval " << interval << ": " << store.checkpointCount() << " checkpoints, "
+                  << store.memoryBytes() << " bytes, at most " << store.maxLookupAdditions()
+                  << " additions per lookup" << std::endl;
+    }
+
+    if (!allGood) {
+        throw 1;
+    }
+    std::cout << "All checkpoint store values match!" << std::endl;
+}
+
 int main(int argc, char* argv[]) {
 
     std::array<uint256_t, fibonacci::MAX_256_BIT_FIBONACCI_INDEX + 1> results = {0};
@@ -82,6 +171,8 @@ int main(int argc, char* argv[]) {
     } else {
         fibonacciVerifier(results, 0, finalFibonacciNumberCount);
     }
+    sequenceVerifier();
+    storeVerifier();
 
     if (finalFibonacciNumberCount == RAN_VERY_FAST) {
 